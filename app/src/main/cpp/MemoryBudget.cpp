@@ -0,0 +1,108 @@
+#include "MemoryBudget.h"
+#include <android/log.h>
+#include <algorithm>
+#include <cstdio>
+
+#define TAG "MemoryBudget"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, TAG, __VA_ARGS__)
+#define LOGW(...) __android_log_print(ANDROID_LOG_WARN, TAG, __VA_ARGS__)
+
+// SRTO_SNDBUF is converted to slots of MSS (1500) minus UDP/IP headers;
+// every srt_sendmsg takes one slot however small the message is
+static const size_t SRT_SLOT_BYTES = 1472;
+static const size_t MIN_SEND_BUFFER_SLOTS = 32;
+// MpegTsMuxer sends at most 7 * 188 bytes per message and flushes a
+// partial message (leftover + PAT/PMT) once per frame
+static const size_t MUXER_MESSAGE_BYTES = 1316;
+static const size_t TS_PACKET_BYTES = 188;
+static const size_t TS_PAYLOAD_BYTES = 184;
+// PAT + PMT + PES header/PCR packet + last-packet stuffing, per frame
+static const size_t TS_PER_FRAME_OVERHEAD_BYTES = 4 * TS_PACKET_BYTES;
+// The only margin left once slots are counted: MediaCodec overshoots the
+// target bitrate around keyframes (percent)
+static const size_t ENCODER_OVERSHOOT_PERCENT = 120;
+// Sender drops unacknowledged packets at max(latency, 1000ms) + 20ms;
+// the rest covers ACK timing and the drop check interval
+static const int SRT_MIN_DROP_THRESHOLD_MS = 1000;
+static const int RETENTION_HEADROOM_MS = 250;
+// SRT's own default latency, the lowest we hand out when clamping
+static const int MIN_LATENCY_MS = 120;
+
+void MemoryBudget::configure(size_t ceilingBytes, int bitrateBps, int framerate, int latencyMs) {
+    Allocation a;
+    a.ceilingBytes = ceilingBytes > 0 ? ceilingBytes : DEFAULT_CEILING_BYTES;
+    a.bitrateBps = bitrateBps > 0 ? bitrateBps : DEFAULT_BITRATE_BPS;
+    a.framerate = framerate > 0 ? framerate : DEFAULT_FRAMERATE;
+    a.requestedLatencyMs = latencyMs > 0 ? latencyMs : DEFAULT_LATENCY_MS;
+    a.latencyMs = a.requestedLatencyMs;
+    a.reservedBytes = MUXER_MESSAGE_BYTES;
+
+    // Messages per second: full 1316-byte messages plus one partial flush per frame
+    size_t tsBytesPerSec = (size_t)a.bitrateBps / 8 * TS_PACKET_BYTES / TS_PAYLOAD_BYTES
+                           + (size_t)a.framerate * TS_PER_FRAME_OVERHEAD_BYTES;
+    size_t messagesPerSec = (tsBytesPerSec + MUXER_MESSAGE_BYTES - 1) / MUXER_MESSAGE_BYTES + a.framerate;
+    size_t slotsPerSec = messagesPerSec * ENCODER_OVERSHOOT_PERCENT / 100;
+
+    size_t retentionMs = std::max(a.requestedLatencyMs, SRT_MIN_DROP_THRESHOLD_MS) + RETENTION_HEADROOM_MS;
+    size_t demandSlots = (slotsPerSec * retentionMs + 999) / 1000;
+    a.demandBytes = demandSlots * SRT_SLOT_BYTES;
+
+    size_t available = a.ceilingBytes > a.reservedBytes ? a.ceilingBytes - a.reservedBytes : 0;
+    size_t availableSlots = available / SRT_SLOT_BYTES;
+    a.sendBufferSlots = std::max(std::min(demandSlots, availableSlots), MIN_SEND_BUFFER_SLOTS);
+    a.sendBufferBytes = a.sendBufferSlots * SRT_SLOT_BYTES;
+    a.clamped = demandSlots > availableSlots;
+
+    if (a.clamped) {
+        // Lower the latency so the sender drops late packets before the
+        // buffer fills, rather than blocking srt_sendmsg on the encoder thread
+        int coveredMs = (int)(a.sendBufferSlots * 1000 / slotsPerSec);
+        a.latencyMs = std::max(coveredMs - RETENTION_HEADROOM_MS, MIN_LATENCY_MS);
+        LOGW("Budget clamped: send buffer covers ~%d ms, latency lowered %d -> %d ms",
+             coveredMs, a.requestedLatencyMs, a.latencyMs);
+    }
+
+    LOGI("Budget: bitrate %d bps @ %d fps, latency %d ms -> SNDBUF %zu bytes (%zu slots, demand %zu, ceiling %zu)",
+         a.bitrateBps, a.framerate, a.latencyMs, a.sendBufferBytes, a.sendBufferSlots,
+         a.demandBytes, a.ceilingBytes);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    allocation_ = a;
+}
+
+MemoryBudget::Allocation MemoryBudget::allocation() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return allocation_;
+}
+
+void MemoryBudget::resetUsage() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    lastUsagePackets_ = 0;
+    lastUsageBytes_ = 0;
+    peakUsagePackets_ = 0;
+}
+
+void MemoryBudget::reportUsage(size_t packetsInUse, size_t bytesInUse) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    lastUsagePackets_ = packetsInUse;
+    lastUsageBytes_ = bytesInUse;
+    peakUsagePackets_ = std::max(peakUsagePackets_, packetsInUse);
+
+    LOGI("Usage: SRT send buffer %zu / %zu slots, %zu bytes (peak %zu slots), ceiling %zu",
+         lastUsagePackets_, allocation_.sendBufferSlots, lastUsageBytes_,
+         peakUsagePackets_, allocation_.ceilingBytes);
+    if (packetsInUse > allocation_.sendBufferSlots * 9 / 10) {
+        LOGW("SRT send buffer above 90%% of budget - link is not keeping up with %d bps", allocation_.bitrateBps);
+    }
+}
+
+std::string MemoryBudget::report() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    char buf[256];
+    snprintf(buf, sizeof buf,
+             "sndbuf %zu/%zu slots, %zu bytes (peak %zu slots), latency %d ms, reserved %zu, ceiling %zu%s",
+             lastUsagePackets_, allocation_.sendBufferSlots, lastUsageBytes_, peakUsagePackets_,
+             allocation_.latencyMs, allocation_.reservedBytes, allocation_.ceilingBytes,
+             allocation_.clamped ? " (clamped)" : "");
+    return std::string(buf);
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+
+// Central memory budget for the native layer.
+// One configured ceiling is divided among the native buffers according to
+// the stream bitrate and SRT latency, instead of every session asking for a
+// fixed 50MB send buffer.
+class MemoryBudget {
+public:
+    struct Allocation {
+        size_t ceilingBytes = 0;        // Configured ceiling for all native buffers
+        size_t reservedBytes = 0;       // Fixed-size buffers (muxer staging)
+        size_t demandBytes = 0;         // What bitrate * latency would like for the SRT send buffer
+        size_t sendBufferBytes = 0;     // SRTO_SNDBUF actually granted
+        size_t sendBufferSlots = 0;     // Messages SRT can hold (one srt_sendmsg per slot)
+        int requestedLatencyMs = 0;     // Latency from the app settings
+        int latencyMs = 0;              // SRTO_LATENCY handed out (lowered when clamped)
+        int bitrateBps = 0;
+        int framerate = 0;
+        bool clamped = false;           // Demand exceeded the ceiling
+    };
+
+    // 16MB covers 15 seconds of 4 Mbps video with headroom, and leaves the
+    // camera and encoder alone on 2GB devices.
+    static constexpr size_t DEFAULT_CEILING_BYTES = 16 * 1024 * 1024;
+    static constexpr int DEFAULT_BITRATE_BPS = 2000000;
+    static constexpr int DEFAULT_FRAMERATE = 30;
+    static constexpr int DEFAULT_LATENCY_MS = 15000;
+
+    // Compute the allocation for a session (<= 0 picks the default)
+    void configure(size_t ceilingBytes, int bitrateBps, int framerate, int latencyMs);
+
+    Allocation allocation() const;
+
+    // Forget usage from the previous session
+    void resetUsage();
+
+    // Record actual SRT send buffer use and log it against the budget
+    void reportUsage(size_t packetsInUse, size_t bytesInUse);
+
+    // One-line summary of budget vs. use, for logging from the app
+    std::string report() const;
+
+private:
+    mutable std::mutex mutex_;
+    Allocation allocation_;
+
+    size_t lastUsagePackets_ = 0;
+    size_t lastUsageBytes_ = 0;
+    size_t peakUsagePackets_ = 0;
+};
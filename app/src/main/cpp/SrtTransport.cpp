@@ -21,11 +21,13 @@ SrtTransport::~SrtTransport() {
     srt_cleanup();
 }
 
-bool SrtTransport::init(const std::string& ip, int port, const std::string& streamId) {
+bool SrtTransport::init(const std::string& ip, int port, const std::string& streamId,
+                        const MemoryBudget::Allocation& allocation) {
     // Store for reconnection
     ip_ = ip;
     port_ = port;
     streamId_ = streamId;
+    allocation_ = allocation;
     
     return connect();
 }
@@ -52,9 +54,9 @@ bool SrtTransport::connect() {
         LOGI("Set StreamID: %s", sid.c_str());
     }
     
-    // HIGH LATENCY for sea/unstable network (15 seconds buffer)
+    // HIGH LATENCY for sea/unstable network (15 seconds buffer by default)
     // This allows the receiver to buffer more data before playback
-    int latency = 15000; // 15 seconds
+    int latency = allocation_.latencyMs;
     srt_setsockopt(socket_, 0, SRTO_LATENCY, &latency, sizeof latency);
     LOGI("Set Latency: %d ms (for sea stability)", latency);
 
@@ -66,13 +68,20 @@ bool SrtTransport::connect() {
     int conntime = 10000;
     srt_setsockopt(socket_, 0, SRTO_CONNTIMEO, &conntime, sizeof conntime);
 
-    // Large flight window for high latency
+    // Large flight window. On a sending caller this does not limit outgoing
+    // traffic (that is the receiver's FC and ACKs), it only bounds what we receive.
     int fc = 32000;
     srt_setsockopt(socket_, 0, SRTO_FC, &fc, sizeof fc);
     
-    // Large sender buffer (50MB for 15 seconds of video)
-    int bufSize = 50000000;
+    // Sender buffer sized from bitrate * latency by the memory budget
+    int bufSize = (int)allocation_.sendBufferBytes;
     srt_setsockopt(socket_, 0, SRTO_SNDBUF, &bufSize, sizeof bufSize);
+    LOGI("Set SNDBUF: %d bytes (%zu slots)", bufSize, allocation_.sendBufferSlots);
+
+    // Non-blocking send: a full buffer drops messages instead of stalling
+    // the MediaCodec output thread (connect stays blocking via SRTO_RCVSYN)
+    bool sndSyn = false;
+    srt_setsockopt(socket_, 0, SRTO_SNDSYN, &sndSyn, sizeof sndSyn);
     
     // Enable peer idle timeout (30 seconds)
     int peerIdleTimeout = 30000;
@@ -115,6 +124,13 @@ void SrtTransport::send(const uint8_t* data, int len) {
     int res = srt_sendmsg(socket_, (const char*)data, len, -1, 0);
     if (res == SRT_ERROR) {
         int errCode = srt_getlasterror(nullptr);
+        if (errCode == SRT_EASYNCSND) {
+            // Send buffer full - drop rather than block the encoder
+            if (droppedMessages_++ % 100 == 0) {
+                LOGW("SRT send buffer full, dropped %d messages so far", droppedMessages_);
+            }
+            return;
+        }
         LOGE("SRT send failed: %s (code: %d)", srt_getlasterror_str(), errCode);
         
         // Connection lost - trigger reconnection
@@ -158,6 +174,17 @@ void SrtTransport::tryReconnect() {
     }).detach();
 }
 
+void SrtTransport::sendBufferInUse(size_t& packets, size_t& bytes) {
+    packets = 0;
+    bytes = 0;
+    if (!connected_ || socket_ == SRT_INVALID_SOCK) return;
+
+    SRT_TRACEBSTATS stats;
+    if (srt_bstats(socket_, &stats, 0) == SRT_ERROR) return;
+    packets = stats.pktSndBuf > 0 ? (size_t)stats.pktSndBuf : 0;
+    bytes = stats.byteSndBuf > 0 ? (size_t)stats.byteSndBuf : 0;
+}
+
 void SrtTransport::release() {
     connected_ = false;
     if (socket_ != SRT_INVALID_SOCK) {
@@ -4,16 +4,21 @@
 #include <vector>
 #include <atomic>
 #include <srt.h>
+#include "MemoryBudget.h"
 
 class SrtTransport {
 public:
     SrtTransport();
     ~SrtTransport();
 
-    bool init(const std::string& ip, int port, const std::string& streamId);
+    bool init(const std::string& ip, int port, const std::string& streamId,
+              const MemoryBudget::Allocation& allocation);
     void send(const uint8_t* data, int len);
     void release();
 
+    // Messages and payload bytes currently held in the SRT send buffer (0 when not connected)
+    void sendBufferInUse(size_t& packets, size_t& bytes);
+
 private:
     bool connect();
     void tryReconnect();
@@ -25,6 +30,12 @@ private:
     std::string ip_;
     int port_ = 0;
     std::string streamId_;
+
+    // Send buffer size and latency from the memory budget
+    MemoryBudget::Allocation allocation_;
+
+    // Messages dropped because the send buffer was full
+    int droppedMessages_ = 0;
     
     // Reconnection state
     std::atomic<bool> reconnecting_{false};
@@ -2,14 +2,27 @@
 #include <string>
 #include <android/log.h>
 #include <memory>
+#include <chrono>
+#include "MemoryBudget.h"
 #include "MpegTsMuxer.h"
 #include "SrtTransport.h"
 
 static std::unique_ptr<SrtTransport> srtTransport;
 static std::unique_ptr<MpegTsMuxer> tsMuxer;
+static MemoryBudget memoryBudget;
+
+// How often nativeSendFrame samples SRT buffer use against the budget
+static const auto USAGE_REPORT_INTERVAL = std::chrono::seconds(5);
+static std::chrono::steady_clock::time_point lastUsageReport;
 
 #define LOG_TAG "NativeLib"
 
+static void reportSendBufferUsage() {
+    size_t packets = 0, bytes = 0;
+    srtTransport->sendBufferInUse(packets, bytes);
+    memoryBudget.reportUsage(packets, bytes);
+}
+
 // Callback from Muxer to send data
 void onMuxerOutput(const uint8_t* data, size_t size) {
     if (srtTransport) {
@@ -26,15 +39,24 @@ Java_com_example_srtsender_MainActivity_nativeInit(
         jobject /* this */,
         jstring ip,
         jint port,
-        jstring boatId) {
+        jstring boatId,
+        jint bitrateBps,
+        jint framerate,
+        jint latencyMs,
+        jlong memoryBudgetBytes) {
     
+    memoryBudget.configure(memoryBudgetBytes > 0 ? (size_t)memoryBudgetBytes : 0,
+                           bitrateBps, framerate, latencyMs);
+    memoryBudget.resetUsage();
+
     const char *ipStr = env->GetStringUTFChars(ip, 0);
     const char *boatIdStr = env->GetStringUTFChars(boatId, 0);
     
     __android_log_print(ANDROID_LOG_INFO, LOG_TAG, "nativeInit: Connecting to %s:%d with streamId %s", ipStr, port, boatIdStr);
     
     srtTransport = std::make_unique<SrtTransport>();
-    bool success = srtTransport->init(ipStr, port, boatIdStr);
+    lastUsageReport = std::chrono::steady_clock::now();
+    bool success = srtTransport->init(ipStr, port, boatIdStr, memoryBudget.allocation());
     
     env->ReleaseStringUTFChars(ip, ipStr);
     env->ReleaseStringUTFChars(boatId, boatIdStr);
@@ -71,6 +93,23 @@ Java_com_example_srtsender_MainActivity_nativeSendFrame(
     
     __android_log_print(ANDROID_LOG_DEBUG, LOG_TAG, "nativeSendFrame: Encoding frame: %d bytes, ts: %lld", length, (long long)timestamp);
     tsMuxer->encode(buf, length, (uint64_t)timestamp);
+
+    auto now = std::chrono::steady_clock::now();
+    if (srtTransport && now - lastUsageReport >= USAGE_REPORT_INTERVAL) {
+        lastUsageReport = now;
+        reportSendBufferUsage();
+    }
+}
+
+extern "C" JNIEXPORT jstring JNICALL
+Java_com_example_srtsender_MainActivity_nativeGetMemoryReport(
+        JNIEnv* env,
+        jobject /* this */) {
+
+    if (srtTransport) {
+        reportSendBufferUsage();
+    }
+    return env->NewStringUTF(memoryBudget.report().c_str());
 }
 
 extern "C" JNIEXPORT void JNICALL
@@ -103,7 +103,7 @@ class LoginActivity : AppCompatActivity() {
             override fun onDataChange(snapshot: DataSnapshot) {
                 var serverIp = "192.168.1.1" // Default fallback
                 var serverPort = 9000 // Default SRT port
-                var srtLatency = 200 // Default latency 200ms
+                var srtLatency = 15000 // Default latency 15s (sea stability)
                 
                 // Read Server URL
                 val url = snapshot.child("serverUrl").getValue(String::class.java)
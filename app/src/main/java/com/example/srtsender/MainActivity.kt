@@ -55,12 +55,16 @@ class MainActivity : AppCompatActivity() {
     private val VIDEO_BITRATE = 2000000 // 2 Mbps
     private val VIDEO_FRAMERATE = 30
 
+    // Ceiling for all native buffers (SRT send buffer, muxer), split by bitrate and latency
+    private val NATIVE_MEMORY_BUDGET = 16L * 1024 * 1024 // 16 MB
+
     // SRT Config (Read from Firebase via Intent, or fallback to 9000)
     private var srtPort: Int = 9000
 
     // JNI
-    external fun nativeInit(ip: String, port: Int, boatId: String): Boolean
+    external fun nativeInit(ip: String, port: Int, boatId: String, bitrateBps: Int, framerate: Int, latencyMs: Int, memoryBudgetBytes: Long): Boolean
     external fun nativeSendFrame(data: ByteBuffer, length: Int, timestamp: Long)
+    external fun nativeGetMemoryReport(): String
     external fun nativeRelease()
 
     companion object {
@@ -80,8 +84,8 @@ class MainActivity : AppCompatActivity() {
     // Room assignment (used in SRT stream path)
     private var assignedRoomId: String? = null
     
-    // SRT Latency (ms) - configurable from Firebase
-    private var srtLatency: Int = 200
+    // SRT Latency (ms) - configurable from Firebase, 15s for sea stability by default
+    private var srtLatency: Int = 15000
     
     // Device role info
     private var deviceRole: String = "racing_boat"
@@ -108,7 +112,7 @@ class MainActivity : AppCompatActivity() {
         hasVideo = intent.getBooleanExtra("HAS_VIDEO", true)
         hasGps = intent.getBooleanExtra("HAS_GPS", true)
         srtPort = intent.getIntExtra("SERVER_PORT", 9000)
-        srtLatency = intent.getIntExtra("SRT_LATENCY", 200)
+        srtLatency = intent.getIntExtra("SRT_LATENCY", 15000)
         val autoStart = intent.getBooleanExtra("AUTO_START", false)
         
         Log.d("MainActivity", "Role: $deviceRole, Video: $hasVideo, GPS: $hasGps, Port: $srtPort, Latency: ${srtLatency}ms, AutoStart: $autoStart")
@@ -259,7 +263,7 @@ class MainActivity : AppCompatActivity() {
                 Log.d("MainActivity", "Resolved $serverIp -> $resolvedIp, Port: $srtPort, StreamPath: $streamPath")
 
                 // 1. Init Native SRT with roomId_boatId format
-                val success = nativeInit(resolvedIp, srtPort, streamPath)
+                val success = nativeInit(resolvedIp, srtPort, streamPath, VIDEO_BITRATE, VIDEO_FRAMERATE, srtLatency, NATIVE_MEMORY_BUDGET)
 
                 runOnUiThread {
                     if (success) {
@@ -342,6 +346,7 @@ class MainActivity : AppCompatActivity() {
             mediaCodec?.stop()
             mediaCodec?.release()
             mediaCodec = null
+            Log.d("MainActivity", "Native memory: ${nativeGetMemoryReport()}")
             nativeRelease()
             
             // Stop Foreground Service